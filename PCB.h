@@ -13,6 +13,8 @@
 #include <string>
 #include <cstdio>
 
+#include "memoryBudget.h"
+
 using namespace std;
 
 #ifndef PCB_H
@@ -27,6 +29,15 @@ public:
 	// Constructor
 	PCB(int p, int sP);
 
+	// A budget charge belongs to exactly one PCB: copies start
+	// without one, moves take it over, and it is returned to the
+	// budget when the PCB is destroyed or assigned over.
+	PCB(const PCB& other);
+	PCB(PCB&& other);
+	PCB& operator=(const PCB& other);
+	PCB& operator=(PCB&& other);
+	~PCB();
+
 	// Getters
 
 	// **********************************************************//
@@ -51,6 +62,26 @@ public:
 	// **********************************************************//
 	int getMemoryLimit() const { return memoryLimit; }
 
+	// **********************************************************//
+	// Returns the memory currently charged to the process.	     //
+	// **********************************************************//
+	int getMemoryUsed() const { return memoryUsed; }
+
+	// **********************************************************//
+	// Returns the priority of the process.			     //
+	// **********************************************************//
+	int getPriority() const { return priority; }
+
+	// **********************************************************//
+	// Returns the memory this process holds in a MemoryBudget.  //
+	// **********************************************************//
+	int getBudgetCharge() const { return budgetCharge; }
+
+	// **********************************************************//
+	// Returns the budget holding that charge, or nullptr.	     //
+	// **********************************************************//
+	const MemoryBudget* getBudget() const { return budget; }
+
 	// **********************************************************//
 	// Temp function to return the run time of the process.	     //
 	// **********************************************************//
@@ -68,6 +99,11 @@ public:
 	// **********************************************************//
 	void setState(int newState) { state = newState; }
 
+	// **********************************************************//
+	// changes the priority of the process (lower is higher).    //
+	// **********************************************************//
+	void setPriority(int newPriority) { priority = newPriority; }
+
 	// **********************************************************//
 	// function to add a file to the list of open files, returns //
 	// 0 adding that file excedes the memory limit.	             //
@@ -85,11 +121,41 @@ public:
 	// **********************************************************//
 	int removeOpenFiles(string file);				// Remove file from open files
 
+	// **********************************************************//
+	// function to reserve the memory limit of the process from  //
+	// a global budget. returns 0 if the budget cannot cover it  //
+	// or the process already holds a charge, 1 otherwise.	     //
+	// **********************************************************//
+	int chargeBudget(MemoryBudget& budget);
+
+	// **********************************************************//
+	// function to return the charge taken by chargeBudget.	     //
+	// returns 0 if the process holds no charge, 1 otherwise.    //
+	// **********************************************************//
+	int releaseBudget();
+
+	// **********************************************************//
+	// function to charge memory to the process. returns 0 if    //
+	// the process holds no budget charge or the memory would    //
+	// exceed that charge, 1 otherwise.			     //
+	// **********************************************************//
+	int reserveMemory(int amount);
+
+	// **********************************************************//
+	// function to return memory charged by reserveMemory.	     //
+	// returns 0 if more than is in use is released, 1 if not.   //
+	// **********************************************************//
+	int releaseMemory(int amount);
+
 private:
 	int pid;							// Process ID
 	int stackPointer;						// Stack pointer
 	int state;							// Process state (running, ready, waiting)
 	int memoryLimit;						// Memory limit
+	int memoryUsed;							// Memory charged against the limit
+	int priority;							// Scheduling priority (lower is higher)
+	MemoryBudget* budget;						// Budget holding this process's memory, if admitted
+	int budgetCharge;						// Amount held in that budget
 	vector<string>openFiles;					// List of open files
 	//int runTime;							// Run time
 
@@ -102,6 +168,10 @@ PCB::PCB()
 	stackPointer = 0;
 	state = 0;							// Default state
 	memoryLimit = 0;						// Default memory limit
+	memoryUsed = 0;							// Nothing charged yet
+	priority = 0;							// Default priority
+	budget = nullptr;						// Not admitted yet
+	budgetCharge = 0;
 	//runTime = 0;							// Default run time
 }
 
@@ -112,9 +182,85 @@ PCB::PCB(int p, int sP)
 	stackPointer = sP;
 	state = 0;							// Default state
 	memoryLimit = 0;						// Default memory limit
+	memoryUsed = 0;							// Nothing charged yet
+	priority = 0;							// Default priority
+	budget = nullptr;						// Not admitted yet
+	budgetCharge = 0;
 	//runTime = 0;							// Default run time
 }
 
+// Copy constructor, the copy holds no budget charge
+PCB::PCB(const PCB& other)
+{
+	pid = other.pid;
+	stackPointer = other.stackPointer;
+	state = other.state;
+	memoryLimit = other.memoryLimit;
+	memoryUsed = 0;							// Usage is backed by the charge, which stays behind
+	priority = other.priority;
+	budget = nullptr;
+	budgetCharge = 0;
+	openFiles = other.openFiles;
+}
+
+// Move constructor, takes over the budget charge
+PCB::PCB(PCB&& other)
+{
+	pid = other.pid;
+	stackPointer = other.stackPointer;
+	state = other.state;
+	memoryLimit = other.memoryLimit;
+	memoryUsed = other.memoryUsed;
+	priority = other.priority;
+	budget = other.budget;
+	budgetCharge = other.budgetCharge;
+	openFiles = move(other.openFiles);
+	other.budget = nullptr;						// The source no longer owns the charge
+	other.budgetCharge = 0;
+	other.memoryUsed = 0;
+}
+
+// Copy assignment, returns this PCB's own charge first
+PCB& PCB::operator=(const PCB& other)
+{
+	if (this != &other) {
+		PCB copy(other);
+		*this = move(copy);
+	}
+	return *this;
+}
+
+// Move assignment, returns this PCB's own charge first
+PCB& PCB::operator=(PCB&& other)
+{
+	if (this != &other) {
+		if (budget != nullptr) {
+			releaseBudget();
+		}
+		pid = other.pid;
+		stackPointer = other.stackPointer;
+		state = other.state;
+		memoryLimit = other.memoryLimit;
+		memoryUsed = other.memoryUsed;
+		priority = other.priority;
+		budget = other.budget;
+		budgetCharge = other.budgetCharge;
+		openFiles = move(other.openFiles);
+		other.budget = nullptr;
+		other.budgetCharge = 0;
+		other.memoryUsed = 0;
+	}
+	return *this;
+}
+
+// Destructor, returns any budget charge so it is never lost
+PCB::~PCB()
+{
+	if (budget != nullptr) {
+		releaseBudget();
+	}
+}
+
 // *****************************************************************//
 // Function to add files to the list of open files.		    //
 // Takes the pathname of the file as a parameter.		    //
@@ -157,6 +303,78 @@ int PCB::removeOpenFiles(string file)
 	return 0;							// File not found
 }
 
+// *****************************************************************//
+// Function to reserve the memory limit of the process from a	    //
+// global budget. Returns 1 if the budget covered it. Returns 0,    //
+// without an error, if the budget is full, since admission then    //
+// simply waits for memory to be released.			    //
+// *****************************************************************//
+int PCB::chargeBudget(MemoryBudget& globalBudget)
+{
+	if (budget != nullptr || memoryLimit < 0) {
+		perror("Error: Process already charged or has no valid memory limit");
+		return 0;
+	}
+	if (!globalBudget.reserve(memoryLimit)) {
+		return 0;						// Budget full
+	}
+	budget = &globalBudget;
+	budgetCharge = memoryLimit;					// Remember what was charged, not the current limit
+	return 1;
+}
+
+// *****************************************************************//
+// Function to return exactly what chargeBudget took from the	    //
+// budget. Memory still reserved by the process is dropped with it. //
+// returns 0 if the process holds no charge, 1 otherwise.	    //
+// *****************************************************************//
+int PCB::releaseBudget()
+{
+	if (budget == nullptr) {
+		perror("Error: Process holds no memory budget charge");
+		return 0;
+	}
+	budget->release(budgetCharge);
+	budget = nullptr;
+	budgetCharge = 0;
+	memoryUsed = 0;
+	return 1;
+}
+
+// *****************************************************************//
+// Function to charge memory to the process.			    //
+// The memory is backed by the budget charge taken at admission, so //
+// if the process holds no charge or the memory would exceed it,    //
+// nothing is charged and 0 is returned. Otherwise 1 is returned.   //
+// *****************************************************************//
+int PCB::reserveMemory(int amount)
+{
+	if (budget == nullptr) {
+		perror("Error: Process has not been admitted to a memory budget");
+		return 0;
+	}
+	if (amount < 0 || amount > budgetCharge - memoryUsed) {
+		perror("Error: Memory limit exceeded");
+		return 0;
+	}
+	memoryUsed += amount;						// Charge the process
+	return 1;
+}
+
+// *****************************************************************//
+// Function to return memory previously charged by reserveMemory.   //
+// returns 0 if the amount is more than is in use, 1 otherwise.	    //
+// *****************************************************************//
+int PCB::releaseMemory(int amount)
+{
+	if (amount < 0 || amount > memoryUsed) {
+		perror("Error: Releasing more memory than is in use");
+		return 0;
+	}
+	memoryUsed -= amount;
+	return 1;
+}
+
 // *****************************************************************//
 // A function to get the list of open files.			    //
 // returns 0 if there are no open files, 1 if there are.	    //
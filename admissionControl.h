@@ -0,0 +1,127 @@
+#ifndef ADMISSION_CONTROL_H
+#define ADMISSION_CONTROL_H
+
+#include <stdexcept>  // For exceptions (e.g., a limit larger than the budget)
+#include <unordered_set>
+
+#include "priorityQueue.h"
+#include "memoryBudget.h"
+#include "PCB.h"
+
+using namespace std;
+
+// ********* Priority Convention: Lower integer value means higher priority *********************************
+//
+// Sits in front of the scheduler's addReadyProcess. A process is only handed on once its PCB memory
+// limit has been charged to the MemoryBudget (PCB::chargeBudget). Processes that do not fit wait in a
+// deferred queue and are admitted in priority order (FIFO within a priority) as memory is released.
+//
+// ReadySink is whatever accepts ready processes: any type with addReadyProcess(PCB*) that queues the
+// process by PCB::getPriority(), the way Scheduler::addReadyProcess does.
+
+template <typename ReadySink>
+class AdmissionController {
+private:
+    ReadySink& scheduler;
+    MemoryBudget& budget;
+    PriorityQueue<PCB*> deferred;
+    unordered_set<const PCB*> deferredSet;   // Processes currently in deferred, to ignore duplicate admits
+
+public:
+    /**
+      * Constructor: Initializes the controller with the scheduler it feeds and the budget it charges.
+      *              Neither is owned.
+      */
+    AdmissionController(ReadySink& scheduler, MemoryBudget& budget) : scheduler(scheduler), budget(budget) {
+    }
+
+    /**
+      * Description: Admits a process to the ready queue if its memory limit fits in the budget,
+      *              otherwise defers it. A process never overtakes a deferred process of the
+      *              same or higher priority, even if it would fit.
+      *              A process that already holds a charge in this budget (e.g. one coming back
+      *              from I/O) goes straight to the scheduler. A process that is already deferred
+      *              is left where it is.
+      *
+      * Parameters:
+      *      process - A pointer to the process becoming ready. Null pointers are ignored.
+      *
+      * Return:
+      *      true - If the process was handed to the scheduler.
+      *      false - If it was deferred, was already deferred, or was null.
+      *
+      * Throws: invalid_argument If the process holds a charge in a different budget, or if its memory
+      *         limit is negative or larger than the whole budget, since it could never be admitted.
+      *
+      * Warnings: A deferred process must stay alive until it is admitted.
+      */
+    bool admit(PCB* process) {
+        if (!process) {
+            return false;
+        }
+        if (process->getBudget() == &budget) {
+            scheduler.addReadyProcess(process);   // Already admitted, just ready again
+            return true;
+        }
+        if (process->getBudget() != nullptr || process->getMemoryLimit() < 0 ||
+            static_cast<size_t>(process->getMemoryLimit()) > budget.getCapacity()) {
+            throw invalid_argument("Process is charged to another budget or its memory limit does not fit in this one");
+        }
+        if (deferredSet.count(process) != 0) {
+            return false;
+        }
+
+        bool waitingAhead = !deferred.is_empty() && deferred.peek()->getPriority() <= process->getPriority();
+        if (!waitingAhead && process->chargeBudget(budget)) {
+            scheduler.addReadyProcess(process);
+            return true;
+        }
+
+        deferred.enqueue(process, process->getPriority());
+        deferredSet.insert(process);
+        return false;
+    }
+
+    /**
+      * Description: Returns an exiting process's charge to the budget and admits deferred
+      *              processes, highest priority first, for as long as the next one fits.
+      *
+      * Parameters:
+      *      process - The exiting process. It must have been admitted by this controller.
+      *
+      * Return: The number of deferred processes that were admitted.
+      * Throws: invalid_argument If the process holds no charge in this controller's budget.
+      */
+    int release(PCB* process) {
+        if (!process || process->getBudget() != &budget) {
+            throw invalid_argument("Process holds no charge in this memory budget");
+        }
+        process->releaseBudget();
+
+        int admitted = 0;
+        while (!deferred.is_empty()) {
+            PCB* next = deferred.peek();
+            if (next->getBudget() != nullptr) {
+                // Charged by some other path while it waited; it no longer needs admission here
+                deferredSet.erase(deferred.dequeue());
+                continue;
+            }
+            if (!next->chargeBudget(budget)) {
+                break;   // Head does not fit yet; nothing behind it may overtake it
+            }
+            deferredSet.erase(deferred.dequeue());
+            scheduler.addReadyProcess(next);
+            admitted++;
+        }
+        return admitted;
+    }
+
+    /**
+      * Description: Gets the number of processes waiting for memory.
+      */
+    size_t deferredCount() const {
+        return deferred.size();
+    }
+};
+
+#endif // ADMISSION_CONTROL_H
@@ -0,0 +1,88 @@
+#ifndef MEMORY_BUDGET_H
+#define MEMORY_BUDGET_H
+
+#include <atomic>
+#include <cstddef>
+
+using namespace std;
+
+// ********* A host-wide memory budget shared by every admitted process ****************************************
+//
+// Admission reserves a process's PCB memory limit here (PCB::chargeBudget) before it reaches the
+// ready queue and returns it when the process exits (PCB::releaseBudget), so the sum of the limits
+// of all admitted processes never exceeds the capacity. Per-process usage is then tracked by
+// PCB::reserveMemory against that charge.
+
+class MemoryBudget {
+private:
+    size_t capacity;
+    atomic<size_t> used{0};
+
+public:
+    /**
+     * Description: Creates a budget of the given capacity, in the same units as PCB::memoryLimit.
+     */
+    explicit MemoryBudget(size_t capacity) : capacity(capacity) {}
+
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+    /**
+     * Description: Reserves memory if it fits in what remains of the budget. Safe to call from any thread.
+     *
+     * Parameters:
+     *      amount: The amount to reserve.
+     *
+     * Return: true if the amount was reserved, false if it would exceed the capacity.
+     */
+    bool reserve(size_t amount) {
+        size_t current = used.load(memory_order_relaxed);
+        do {
+            if (amount > capacity - current) {
+                return false;
+            }
+        } while (!used.compare_exchange_weak(current, current + amount, memory_order_acq_rel));
+        return true;
+    }
+
+    /**
+     * Description: Returns memory previously reserved. Safe to call from any thread.
+     *
+     * Parameters:
+     *      amount: The amount to release.
+     *
+     * Return: true if the amount was released, false (and nothing released) if it is more than is reserved.
+     */
+    bool release(size_t amount) {
+        size_t current = used.load(memory_order_relaxed);
+        do {
+            if (amount > current) {
+                return false;
+            }
+        } while (!used.compare_exchange_weak(current, current - amount, memory_order_acq_rel));
+        return true;
+    }
+
+    /**
+     * Description: Gets the amount currently reserved.
+     */
+    size_t inUse() const {
+        return used.load(memory_order_acquire);
+    }
+
+    /**
+     * Description: Gets the amount that can still be reserved.
+     */
+    size_t available() const {
+        return capacity - inUse();
+    }
+
+    /**
+     * Description: Gets the total size of the budget.
+     */
+    size_t getCapacity() const {
+        return capacity;
+    }
+};
+
+#endif // MEMORY_BUDGET_H
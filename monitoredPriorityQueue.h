@@ -0,0 +1,380 @@
+#ifndef MONITORED_PRIORITY_QUEUE_H
+#define MONITORED_PRIORITY_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <queue>
+#include <set>
+#include <sstream>    // For toString method
+#include <stdexcept>  // For exceptions (e.g., dequeue from empty)
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+// ********* Priority Convention: Lower integer value means higher priority *********************************
+//
+// A PriorityQueue that also publishes a per-priority summary (depth and oldest waiting item) that
+// monitoring threads can read with snapshot() while the dispatcher keeps calling enqueue/dequeue.
+//
+// The summary is a fixed table guarded by a sequence lock. The writer bumps the sequence to odd,
+// updates the table with relaxed atomic stores, then bumps it back to even. A reader copies the
+// table and retries if the sequence was odd or changed in between. The writer never waits for a
+// reader, and each enqueue/dequeue costs two sequence stores, one fence, and a few relaxed stores.
+//
+// The table has one row per priority up to a fixed number of rows, plus an overflow row. Any int
+// priority is accepted: once the rows are taken, further priorities share the overflow row until
+// they empty out. The overflow row reports their combined depth and the front of the highest of them.
+//
+// enqueue/dequeue/peek/clear are single-writer, like PriorityQueue. Only snapshot() may be called
+// from other threads.
+//
+// It has the same public methods as PriorityQueue and is meant to replace it as the ready queue:
+// Scheduler holds a PriorityQueue<QueueItem>&, which has to become MonitoredPriorityQueue<QueueItem>&
+// for the ready queue to be snapshotted. PriorityQueue is left non-virtual so that its other users
+// do not pay for a virtual call or for the summary table.
+
+// One priority level as seen by a monitoring reader
+template <typename T>
+struct LevelSnapshot {
+    int priority;
+    size_t depth;
+    uint64_t oldestTicket;   // Enqueue order of the item at the front of this level
+    T oldestItem;
+    bool overflow;           // Row aggregates priorities that did not fit in the table (see above)
+};
+
+// A consistent view of the whole queue at one point between two writer operations
+template <typename T>
+struct QueueSnapshot {
+    vector<LevelSnapshot<T>> levels;   // Non-empty levels, highest priority first
+    size_t total = 0;
+    uint64_t nextTicket = 0;           // Ticket the next enqueue will get
+
+    /**
+     * Description: Finds the level whose front item has waited longest (smallest ticket).
+     *
+     * Return: A pointer into levels, or nullptr if the snapshot is empty.
+     */
+    const LevelSnapshot<T>* oldest() const {
+        const LevelSnapshot<T>* result = nullptr;
+        for (const LevelSnapshot<T>& level : levels) {
+            if (!result || level.oldestTicket < result->oldestTicket) {
+                result = &level;
+            }
+        }
+        return result;
+    }
+};
+
+template <typename T>
+class MonitoredPriorityQueue {
+    static_assert(is_trivially_copyable<T>::value, "MonitoredPriorityQueue publishes items through atomics");
+    static_assert(atomic<T>::is_always_lock_free, "MonitoredPriorityQueue items must fit in a lock-free atomic (e.g. a PID or a pointer)");
+
+private:
+    struct Entry {
+        T item;
+        uint64_t ticket;
+    };
+
+    struct Level {
+        queue<Entry> items;
+        int slot;            // Index of this level's row in the summary table (overflowRow if shared)
+    };
+
+    struct Summary {
+        atomic<int> priority{0};
+        atomic<size_t> depth{0};         // 0 means the row is unused
+        atomic<uint64_t> oldestTicket{0};
+        atomic<T> oldestItem{};
+    };
+
+    // Writer-private state, same shape as PriorityQueue
+    map<int, Level> queues;
+    size_t total_size = 0;
+    uint64_t nextTicket = 0;
+    vector<int> freeSlots;
+    set<int> overflowPriorities;   // Non-empty priorities sharing the overflow row
+    size_t overflowDepth = 0;
+
+    // Reader-visible state
+    size_t maxLevels;
+    int overflowRow;                 // Index of the shared row, after the maxLevels dedicated rows
+    unique_ptr<Summary[]> summaries;
+    atomic<size_t> publishedTotal{0};
+    atomic<uint64_t> publishedNextTicket{0};
+    atomic<uint64_t> sequence{0};
+
+public:
+    /**
+     * Description: Creates an empty queue whose summary gives up to maxLevels non-empty priorities
+     *              a row of their own; any further priorities share the overflow row.
+     */
+    explicit MonitoredPriorityQueue(size_t maxLevels = 64)
+        : maxLevels(maxLevels), overflowRow(static_cast<int>(maxLevels)), summaries(new Summary[maxLevels + 1]) {
+        freeSlots.reserve(maxLevels);
+        for (size_t i = maxLevels; i > 0; i--) {
+            freeSlots.push_back(static_cast<int>(i - 1));
+        }
+    }
+
+    virtual ~MonitoredPriorityQueue() = default;
+
+    MonitoredPriorityQueue(const MonitoredPriorityQueue&) = delete;
+    MonitoredPriorityQueue& operator=(const MonitoredPriorityQueue&) = delete;
+
+    /**
+     * Description: Adds an item to the queue with a given priority. Items of the same priority are processed FIFO.
+     *
+     * Parameters:
+     *      item: The item to add to the queue.
+     *      priority: The priority level (lower value means higher priority).
+     */
+    void enqueue(const T& item, int priority) {
+        auto it = queues.find(priority);
+        if (it == queues.end()) {
+            Level level;
+            if (freeSlots.empty()) {
+                level.slot = overflowRow;
+                overflowPriorities.insert(priority);
+            }
+            else {
+                level.slot = freeSlots.back();
+                freeSlots.pop_back();
+            }
+            it = queues.emplace(priority, move(level)).first;
+        }
+
+        Level& level = it->second;
+        Entry entry;
+        entry.item = item;
+        entry.ticket = nextTicket++;
+        level.items.push(entry);
+        total_size++;
+
+        if (level.slot == overflowRow) {
+            overflowDepth++;
+        }
+
+        uint64_t seq = beginWrite();
+        if (level.slot == overflowRow) {
+            publishOverflow();
+        }
+        else {
+            Summary& summary = summaries[level.slot];
+            if (level.items.size() == 1) {
+                summary.priority.store(priority, memory_order_relaxed);
+                summary.oldestTicket.store(entry.ticket, memory_order_relaxed);
+                summary.oldestItem.store(entry.item, memory_order_relaxed);
+            }
+            summary.depth.store(level.items.size(), memory_order_relaxed);
+        }
+        endWrite(seq);
+    }
+
+    /**
+     * Description: Removes and returns the highest priority item from the queue.
+     *              If multiple items share the highest priority, the one enqueued first (FIFO) is returned.
+     *
+     * Return: The highest priority item (by value).
+     * Throws: out_of_range If the queue is empty.
+     */
+    T dequeue() {
+        if (is_empty()) {
+            throw out_of_range("Dequeue called on an empty MonitoredPriorityQueue");
+        }
+
+        auto highest_prio_it = queues.begin();
+        Level& level = highest_prio_it->second;
+        T item = level.items.front().item;
+        level.items.pop();
+        total_size--;
+
+        bool emptied = level.items.empty();
+        if (level.slot == overflowRow) {
+            overflowDepth--;
+            if (emptied) {
+                overflowPriorities.erase(highest_prio_it->first);
+            }
+        }
+
+        uint64_t seq = beginWrite();
+        if (level.slot == overflowRow) {
+            publishOverflow();
+        }
+        else {
+            Summary& summary = summaries[level.slot];
+            summary.depth.store(level.items.size(), memory_order_relaxed);
+            if (!emptied) {
+                summary.oldestTicket.store(level.items.front().ticket, memory_order_relaxed);
+                summary.oldestItem.store(level.items.front().item, memory_order_relaxed);
+            }
+        }
+        endWrite(seq);
+
+        if (emptied) {
+            if (level.slot != overflowRow) {
+                freeSlots.push_back(level.slot);
+            }
+            queues.erase(highest_prio_it);
+        }
+        return item;
+    }
+
+    /**
+     * Description: Returns a const reference to the highest priority item without removing it.
+     *
+     * Throws: out_of_range If the queue is empty.
+     * Warnings: The returned reference is only valid until the next enqueue/dequeue.
+     */
+    const T& peek() const {
+        if (is_empty()) {
+            throw out_of_range("Peek called on an empty MonitoredPriorityQueue");
+        }
+        return queues.begin()->second.items.front().item;
+    }
+
+    /**
+     * Description: Checks if the queue is empty. Writer thread only; readers use snapshot().
+     */
+    bool is_empty() const {
+        return total_size == 0;
+    }
+
+    /**
+     * Description: Gets the total number of items. Writer thread only; readers use snapshot().
+     */
+    size_t size() const {
+        return total_size;
+    }
+
+    /**
+     * Description: Removes all items from the queue.
+     */
+    void clear() {
+        uint64_t seq = beginWrite();
+        for (auto& entry : queues) {
+            summaries[entry.second.slot].depth.store(0, memory_order_relaxed);
+            if (entry.second.slot != overflowRow) {
+                freeSlots.push_back(entry.second.slot);
+            }
+        }
+        overflowPriorities.clear();
+        overflowDepth = 0;
+        queues.clear();
+        total_size = 0;
+        endWrite(seq);
+    }
+
+    /**
+     * Description: Provides a string representation of the queue contents (for debugging).
+     *              Writer thread only; readers use snapshot().
+     *
+     * Return: A string describing the queue state.
+     */
+    string toString() const {
+        if (is_empty()) {
+            return "MonitoredPriorityQueue: Is empty";
+        }
+
+        stringstream ss;
+        ss << "MonitoredPriorityQueue (Highest Priority First):\n";
+        for (auto it = queues.begin(); it != queues.end(); ++it) {
+            queue<Entry> temp_q = it->second.items;
+            ss << "  Priority " << it->first << ": [";
+            bool first = true;
+            while (!temp_q.empty()) {
+                if (!first) {
+                    ss << ", ";
+                }
+                ss << temp_q.front().item;
+                temp_q.pop();
+                first = false;
+            }
+            ss << "]\n";
+        }
+        ss << "Total items: " << size();
+        return ss.str();
+    }
+
+    /**
+     * Description: Takes a consistent snapshot of the queue summary. Safe to call from any thread
+     *              while the writer runs; never blocks the writer, but retries while a write is in progress.
+     *
+     * Return: The depth and oldest item of every non-empty priority level, plus the total size.
+     */
+    QueueSnapshot<T> snapshot() const {
+        QueueSnapshot<T> result;
+        result.levels.reserve(maxLevels + 1);
+
+        while (true) {
+            uint64_t before = sequence.load(memory_order_acquire);
+            if (before & 1) {
+                continue;   // Write in progress
+            }
+
+            result.levels.clear();
+            for (size_t i = 0; i <= maxLevels; i++) {
+                const Summary& summary = summaries[i];
+                size_t depth = summary.depth.load(memory_order_relaxed);
+                if (depth == 0) {
+                    continue;
+                }
+                LevelSnapshot<T> level;
+                level.priority = summary.priority.load(memory_order_relaxed);
+                level.depth = depth;
+                level.oldestTicket = summary.oldestTicket.load(memory_order_relaxed);
+                level.oldestItem = summary.oldestItem.load(memory_order_relaxed);
+                level.overflow = (i == maxLevels);
+                result.levels.push_back(level);
+            }
+            result.total = publishedTotal.load(memory_order_relaxed);
+            result.nextTicket = publishedNextTicket.load(memory_order_relaxed);
+
+            atomic_thread_fence(memory_order_acquire);
+            if (sequence.load(memory_order_relaxed) == before) {
+                break;
+            }
+        }
+
+        sort(result.levels.begin(), result.levels.end(),
+             [](const LevelSnapshot<T>& a, const LevelSnapshot<T>& b) { return a.priority < b.priority; });
+        return result;
+    }
+
+private:
+    // Marks the summary as being written (odd sequence). Only the writer modifies sequence.
+    uint64_t beginWrite() {
+        uint64_t seq = sequence.load(memory_order_relaxed);
+        sequence.store(seq + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+        return seq;
+    }
+
+    // Rewrites the overflow row from the writer-private overflow state. Called inside a write.
+    void publishOverflow() {
+        Summary& summary = summaries[overflowRow];
+        summary.depth.store(overflowDepth, memory_order_relaxed);
+        if (overflowDepth == 0) {
+            return;
+        }
+        int priority = *overflowPriorities.begin();
+        const Entry& front = queues.find(priority)->second.items.front();
+        summary.priority.store(priority, memory_order_relaxed);
+        summary.oldestTicket.store(front.ticket, memory_order_relaxed);
+        summary.oldestItem.store(front.item, memory_order_relaxed);
+    }
+
+    // Publishes the totals and marks the summary consistent again (even sequence)
+    void endWrite(uint64_t seq) {
+        publishedTotal.store(total_size, memory_order_relaxed);
+        publishedNextTicket.store(nextTicket, memory_order_relaxed);
+        sequence.store(seq + 2, memory_order_release);
+    }
+};
+
+#endif // MONITORED_PRIORITY_QUEUE_H
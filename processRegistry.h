@@ -0,0 +1,218 @@
+#ifndef PROCESS_REGISTRY_H
+#define PROCESS_REGISTRY_H
+
+#include <vector>
+#include <cstdint>
+#include <climits>
+#include <stdexcept>  // For exceptions (e.g., invalid capacity)
+
+#include "PCB.h"
+
+using namespace std;
+
+// ********* PIDs are slot indices. PID 0 is reserved and never handed out, so a default handle is invalid *****
+
+/**
+ * Description: A reference to a registered process. The generation is bumped every time a PID
+ *              is released, so a handle kept across a recycle no longer resolves.
+ */
+struct ProcessHandle {
+    int pid = 0;
+    uint32_t generation = 0;
+
+    bool valid() const { return pid != 0; }
+};
+
+class ProcessRegistry {
+private:
+    struct Slot {
+        PCB process;
+        uint32_t generation = 0;   // Incremented on every remove (wraps after 2^32 reuses of one PID)
+        int nextFree = 0;          // Next recycled PID while this slot is on the free list
+        bool live = false;
+    };
+
+    // Dense slot map indexed by PID. Capacity is reserved up front and slots are appended
+    // with emplace_back, so the vector never reallocates and never moves a live PCB.
+    vector<Slot> slots;
+
+    // Intrusive FIFO free list of recycled PIDs (0 means empty). Released PIDs go on the tail and are
+    // reused from the head, so a PID is handed out again as late as possible and a late signal or
+    // I/O completion carrying a raw PID is unlikely to reach a new process.
+    int freeHead = 0;
+    int freeTail = 0;
+
+    size_t maxProcesses;
+    size_t liveCount = 0;
+
+public:
+    /**
+     * Description: Creates a registry that can hold up to maxProcesses live processes at once.
+     *              All memory is reserved here; create/get/find/remove never allocate.
+     *
+     * Parameters:
+     *      maxProcesses: The maximum number of live processes (and the largest PID handed out).
+     * Throws: invalid_argument If maxProcesses is 0 or does not fit in a PID.
+     */
+    explicit ProcessRegistry(size_t maxProcesses) : maxProcesses(maxProcesses) {
+        if (maxProcesses == 0 || maxProcesses >= static_cast<size_t>(INT_MAX)) {
+            throw invalid_argument("ProcessRegistry capacity must be between 1 and INT_MAX - 1");
+        }
+        slots.reserve(maxProcesses + 1);
+        slots.emplace_back();   // Slot 0 backs the reserved PID
+    }
+
+    /**
+     * Description: Allocates a PID and constructs the process's PCB in place. O(1).
+     *              PIDs that were never used are handed out first, then released PIDs in the order
+     *              they were released.
+     *
+     * Parameters:
+     *      stackPointer: The stack pointer passed to the PCB constructor.
+     *
+     * Return: A handle to the new process, or an invalid handle if the registry is full.
+     */
+    ProcessHandle create(int stackPointer) {
+        int pid;
+        if (slots.size() <= maxProcesses) {
+            pid = static_cast<int>(slots.size());
+            slots.emplace_back();   // Within reserved capacity, no reallocation
+        }
+        else if (freeHead != 0) {
+            pid = freeHead;
+            freeHead = slots[pid].nextFree;
+            if (freeHead == 0) {
+                freeTail = 0;
+            }
+        }
+        else {
+            return ProcessHandle();
+        }
+
+        Slot& slot = slots[pid];
+        slot.process = PCB(pid, stackPointer);
+        slot.nextFree = 0;
+        slot.live = true;
+        liveCount++;
+
+        ProcessHandle handle;
+        handle.pid = pid;
+        handle.generation = slot.generation;
+        return handle;
+    }
+
+    /**
+     * Description: Resolves a handle to its process. O(1).
+     *
+     * Return: A pointer to the PCB, or nullptr if the handle is invalid or stale
+     *         (the PID was released, and possibly recycled, since the handle was issued).
+     *
+     * Warnings: The pointer is only valid until the process is removed.
+     */
+    PCB* get(ProcessHandle handle) {
+        Slot* slot = liveSlot(handle.pid);
+        if (!slot || slot->generation != handle.generation) {
+            return nullptr;
+        }
+        return &slot->process;
+    }
+
+    const PCB* get(ProcessHandle handle) const {
+        const Slot* slot = liveSlot(handle.pid);
+        if (!slot || slot->generation != handle.generation) {
+            return nullptr;
+        }
+        return &slot->process;
+    }
+
+    /**
+     * Description: Looks up the process currently holding a raw PID (e.g. one carried by a signal
+     *              or an I/O completion). O(1). Prefer handleOf() when the caller will hold on to
+     *              the reference, so a later recycle is detected.
+     *
+     * Return: A pointer to the PCB, or nullptr if no live process has that PID.
+     */
+    PCB* find(int pid) {
+        Slot* slot = liveSlot(pid);
+        return slot ? &slot->process : nullptr;
+    }
+
+    const PCB* find(int pid) const {
+        const Slot* slot = liveSlot(pid);
+        return slot ? &slot->process : nullptr;
+    }
+
+    /**
+     * Description: Returns a generation-checked handle for the process currently holding pid.
+     *
+     * Return: The handle, or an invalid handle if no live process has that PID.
+     */
+    ProcessHandle handleOf(int pid) const {
+        ProcessHandle handle;
+        const Slot* slot = liveSlot(pid);
+        if (slot) {
+            handle.pid = pid;
+            handle.generation = slot->generation;
+        }
+        return handle;
+    }
+
+    /**
+     * Description: Removes a process and puts its PID at the back of the free list for reuse. O(1).
+     *              Outstanding handles to the process become stale.
+     *
+     * Return: true if the process was removed, false if the handle was invalid or stale.
+     */
+    bool remove(ProcessHandle handle) {
+        Slot* slot = liveSlot(handle.pid);
+        if (!slot || slot->generation != handle.generation) {
+            return false;
+        }
+
+        slot->process = PCB();   // Drop the old process's open files
+        slot->live = false;
+        slot->generation++;
+        slot->nextFree = 0;
+        if (freeTail != 0) {
+            slots[freeTail].nextFree = handle.pid;
+        }
+        else {
+            freeHead = handle.pid;
+        }
+        freeTail = handle.pid;
+        liveCount--;
+        return true;
+    }
+
+    /**
+     * Description: Gets the number of live processes.
+     */
+    size_t size() const {
+        return liveCount;
+    }
+
+    /**
+     * Description: Gets the maximum number of live processes.
+     */
+    size_t capacity() const {
+        return maxProcesses;
+    }
+
+private:
+    // Returns the slot for pid if it is in range and holds a live process, nullptr otherwise
+    Slot* liveSlot(int pid) {
+        if (pid <= 0 || static_cast<size_t>(pid) >= slots.size() || !slots[pid].live) {
+            return nullptr;
+        }
+        return &slots[pid];
+    }
+
+    const Slot* liveSlot(int pid) const {
+        if (pid <= 0 || static_cast<size_t>(pid) >= slots.size() || !slots[pid].live) {
+            return nullptr;
+        }
+        return &slots[pid];
+    }
+};
+
+#endif // PROCESS_REGISTRY_H
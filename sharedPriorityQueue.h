@@ -0,0 +1,436 @@
+#ifndef SHARED_PRIORITY_QUEUE_H
+#define SHARED_PRIORITY_QUEUE_H
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>  // For exceptions (e.g., dequeue from empty, shm failures)
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+// ********* Priority Convention: Lower integer value means higher priority *********************************
+//
+// A PriorityQueue laid out in a named POSIX shared-memory region so that producer processes on the
+// same host can enqueue directly and the scheduler can dequeue without copying through a socket.
+//
+//   - Priorities are fixed levels 0 .. levels-1, each backed by a bounded ring of fixed-size slots.
+//   - The region holds no raw pointers; everything is located by offsets from the mapping base, so
+//     each process may map it at a different address.
+//   - Any number of producers may enqueue concurrently (lock-free). Exactly one consumer may dequeue.
+//   - Items are copied into the slot bytes, so T must be trivially copyable (e.g. a PID, not a Process*).
+//
+// Each slot has one 64-bit state word: the upper 32 bits are the ring position the slot currently
+// serves, the lower 32 bits are FREE, PUBLISHED, or the PID of the producer that claimed it. Because
+// the claim and the claimant's identity are written by a single CAS, a producer that dies between
+// claiming and publishing is detectable: the consumer sees a claim owned by a PID that no longer
+// exists and discards the slot instead of waiting on it forever.
+//
+// Liveness is checked with kill(pid, 0), which has two known limits:
+//   - If the OS recycles a dead producer's PID before the consumer looks, the claim looks live and
+//     that level stays blocked until the new holder of the PID exits.
+//   - Producers must share the consumer's PID namespace. A producer in another namespace (e.g. a
+//     different container) claims under a PID the consumer cannot see, so its slots are reclaimed
+//     as abandoned while it is still writing; its publish() then fails and the item is dropped.
+
+template <typename T>
+class SharedPriorityQueue {
+    static_assert(is_trivially_copyable<T>::value, "SharedPriorityQueue items are copied between processes");
+    static_assert(atomic<uint64_t>::is_always_lock_free, "Shared-memory atomics must be lock-free");
+
+private:
+    static const uint64_t MAGIC = 0x5350515545554531ULL;   // "SPQUEUE1"
+    static const uint32_t FREE = 0;
+    static const uint32_t PUBLISHED = 0xFFFFFFFFu;
+
+    struct Header {
+        atomic<uint64_t> magic;        // Written last by the creator; attachers check it
+        uint64_t regionSize;
+        uint64_t slotSize;             // sizeof(Slot), catches attaching with a different T
+        uint64_t levelsOffset;
+        uint64_t slotsOffset;
+        uint32_t levels;
+        uint32_t slotsPerLevel;        // Power of two
+    };
+
+    struct alignas(64) Level {
+        atomic<uint64_t> tail;                 // Next position to claim (producers)
+        alignas(64) atomic<uint64_t> head;     // Next position to consume (consumer only)
+        atomic<uint64_t> abandoned;            // Slots discarded after a producer died mid-enqueue
+    };
+
+    struct Slot {
+        atomic<uint64_t> state;
+        T item;
+    };
+
+    unsigned char* base = nullptr;
+    size_t mappedSize = 0;
+
+public:
+    /**
+     * Description: Creates and initializes a new shared-memory queue.
+     *
+     * Parameters:
+     *      name: The POSIX shared-memory name (e.g. "/scheduler_ready").
+     *      levels: The number of priority levels; valid priorities are 0 .. levels-1.
+     *      slotsPerLevel: The capacity of each level, rounded up to a power of two.
+     *
+     * Throws: invalid_argument If levels or slotsPerLevel is 0.
+     *         runtime_error If the region already exists or cannot be created/mapped.
+     */
+    SharedPriorityQueue(const string& name, int levels, size_t slotsPerLevel) {
+        if (levels <= 0 || slotsPerLevel == 0 || slotsPerLevel > (1u << 30)) {
+            throw invalid_argument("SharedPriorityQueue needs at least one level and one slot per level");
+        }
+        uint32_t slots = 1;
+        while (slots < slotsPerLevel) {
+            slots <<= 1;
+        }
+
+        uint64_t levelsOffset = alignUp(sizeof(Header), 64);
+        uint64_t slotsOffset = alignUp(levelsOffset + sizeof(Level) * levels, 64);
+        uint64_t regionSize = slotsOffset + sizeof(Slot) * slots * static_cast<uint64_t>(levels);
+
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            throw runtime_error("shm_open(" + name + ") failed: " + strerror(errno));
+        }
+        if (ftruncate(fd, regionSize) != 0) {
+            int err = errno;
+            close(fd);
+            shm_unlink(name.c_str());
+            throw runtime_error("ftruncate(" + name + ") failed: " + strerror(err));
+        }
+        map(fd, regionSize, name);
+
+        Header* header = new (base) Header();
+        header->regionSize = regionSize;
+        header->slotSize = sizeof(Slot);
+        header->levelsOffset = levelsOffset;
+        header->slotsOffset = slotsOffset;
+        header->levels = levels;
+        header->slotsPerLevel = slots;
+
+        for (int l = 0; l < levels; l++) {
+            Level* level = new (levelAt(l)) Level();
+            level->tail.store(0, memory_order_relaxed);
+            level->head.store(0, memory_order_relaxed);
+            level->abandoned.store(0, memory_order_relaxed);
+            for (uint32_t i = 0; i < slots; i++) {
+                Slot* slot = new (slotAt(l, i)) Slot();
+                slot->state.store(stateWord(i, FREE), memory_order_relaxed);
+            }
+        }
+
+        header->magic.store(MAGIC, memory_order_release);
+    }
+
+    /**
+     * Description: Attaches to a queue created by another process.
+     *
+     * Parameters:
+     *      name: The POSIX shared-memory name the queue was created with.
+     *
+     * Throws: runtime_error If the region does not exist, is not initialized, or was created with a different T.
+     */
+    explicit SharedPriorityQueue(const string& name) {
+        int fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            throw runtime_error("shm_open(" + name + ") failed: " + strerror(errno));
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+            close(fd);
+            throw runtime_error("SharedPriorityQueue region " + name + " is too small");
+        }
+        map(fd, st.st_size, name);
+
+        const Header* h = header();
+        if (h->magic.load(memory_order_acquire) != MAGIC || h->regionSize > mappedSize || h->slotSize != sizeof(Slot)) {
+            munmap(base, mappedSize);
+            base = nullptr;
+            throw runtime_error("SharedPriorityQueue region " + name + " is not initialized or has a different item type");
+        }
+    }
+
+    // Unmaps the region. The region itself persists until remove() is called.
+    virtual ~SharedPriorityQueue() {
+        if (base) {
+            munmap(base, mappedSize);
+        }
+    }
+
+    SharedPriorityQueue(const SharedPriorityQueue&) = delete;
+    SharedPriorityQueue& operator=(const SharedPriorityQueue&) = delete;
+
+    /**
+     * Description: Removes the named region. Processes that still have it mapped keep working.
+     */
+    static void remove(const string& name) {
+        shm_unlink(name.c_str());
+    }
+
+    /**
+     * Description: A slot claimed by claim() and not yet published.
+     */
+    struct Reservation {
+        uint32_t level = 0;
+        uint64_t position = 0;
+    };
+
+    /**
+     * Description: Adds an item to the queue with a given priority. Items of the same priority are processed FIFO.
+     *              Safe to call from any number of processes and threads at once.
+     *
+     * Parameters:
+     *      item: The item to copy into the queue.
+     *      priority: The priority level (lower value means higher priority).
+     *
+     * Return: true if the item was enqueued, false if that priority level is full
+     *         (or, see the header comment, the consumer wrongly reclaimed the slot).
+     * Throws: out_of_range If priority is outside 0 .. levels-1.
+     */
+    bool enqueue(const T& item, int priority) {
+        Reservation reservation;
+        T* slot = claim(priority, reservation);
+        if (!slot) {
+            return false;
+        }
+        *slot = item;
+        return publish(reservation);
+    }
+
+    /**
+     * Description: First half of enqueue: claims the next slot at a priority level so the caller can
+     *              write the item in place. The item is not visible to the consumer until publish().
+     *              A producer that exits between claim() and publish() leaves a slot the consumer discards.
+     *
+     * Parameters:
+     *      priority: The priority level (lower value means higher priority).
+     *      reservation: Receives the claimed position, to be passed to publish().
+     *
+     * Return: A pointer to the slot's item, or nullptr if that priority level is full.
+     * Throws: out_of_range If priority is outside 0 .. levels-1.
+     */
+    T* claim(int priority, Reservation& reservation) {
+        if (priority < 0 || static_cast<uint32_t>(priority) >= header()->levels) {
+            throw out_of_range("Priority outside the levels of this SharedPriorityQueue");
+        }
+        Level* level = levelAt(priority);
+        uint32_t slots = header()->slotsPerLevel;
+        uint32_t tag = ownTag();
+
+        while (true) {
+            uint64_t pos = level->tail.load(memory_order_acquire);
+            Slot* slot = slotAt(priority, pos & (slots - 1));
+            uint64_t state = slot->state.load(memory_order_acquire);
+
+            if (state == stateWord(pos, FREE)) {
+                // Claim the slot and record who claimed it in one step
+                if (slot->state.compare_exchange_strong(state, stateWord(pos, tag), memory_order_acq_rel)) {
+                    // Fails harmlessly if another producer already helped tail past pos
+                    uint64_t expected = pos;
+                    level->tail.compare_exchange_strong(expected, pos + 1, memory_order_acq_rel);
+                    reservation.level = priority;
+                    reservation.position = pos;
+                    return &slot->item;
+                }
+            }
+            else if (positionOf(state) == static_cast<uint32_t>(pos)) {
+                // Another producer claimed this position but has not advanced tail yet (or died); help it along
+                uint64_t expected = pos;
+                level->tail.compare_exchange_strong(expected, pos + 1, memory_order_acq_rel);
+            }
+            else if (positionOf(state) == static_cast<uint32_t>(pos - slots)) {
+                if (level->tail.load(memory_order_acquire) == pos) {
+                    // The slot still holds an item from the previous lap: the level is full
+                    return nullptr;
+                }
+            }
+            else {
+                // The consumer has already freed this slot for the next lap (it discarded an abandoned
+                // claim) but has not advanced tail yet; help it along
+                uint64_t expected = pos;
+                level->tail.compare_exchange_strong(expected, pos + 1, memory_order_acq_rel);
+            }
+        }
+    }
+
+    /**
+     * Description: Second half of enqueue: makes the item written through claim() visible to the consumer.
+     *
+     * Parameters:
+     *      reservation: The reservation filled in by claim().
+     *
+     * Return: true if the item was published, false if the consumer had already reclaimed the slot.
+     */
+    bool publish(const Reservation& reservation) {
+        Slot* slot = slotAt(reservation.level, reservation.position & (header()->slotsPerLevel - 1));
+        uint64_t claimed = stateWord(reservation.position, ownTag());
+        return slot->state.compare_exchange_strong(claimed, stateWord(reservation.position, PUBLISHED), memory_order_acq_rel);
+    }
+
+    /**
+     * Description: Removes the highest priority published item, if any. Must only be called by the single consumer.
+     *              Slots claimed by producers that have since exited are discarded.
+     *
+     * Parameters:
+     *      item: Receives the dequeued item.
+     *
+     * Return: true if an item was dequeued, false if no item is ready.
+     */
+    bool tryDequeue(T& item) {
+        uint32_t levels = header()->levels;
+        uint32_t slots = header()->slotsPerLevel;
+
+        for (uint32_t l = 0; l < levels; l++) {
+            Level* level = levelAt(l);
+            while (true) {
+                uint64_t pos = level->head.load(memory_order_relaxed);
+                Slot* slot = slotAt(l, pos & (slots - 1));
+                uint64_t state = slot->state.load(memory_order_acquire);
+                uint32_t tag = static_cast<uint32_t>(state);
+
+                if (positionOf(state) != static_cast<uint32_t>(pos) || tag == FREE) {
+                    break;   // Nothing at this level
+                }
+                if (tag == PUBLISHED) {
+                    item = slot->item;
+                    release(level, slot, pos, slots);
+                    return true;
+                }
+                if (producerAlive(tag)) {
+                    break;   // Enqueue still in flight; later items at this level wait behind it
+                }
+                // The claiming producer crashed before publishing: drop the slot and look again
+                if (slot->state.compare_exchange_strong(state, stateWord(pos + slots, FREE), memory_order_acq_rel)) {
+                    // It may also have died before advancing tail
+                    uint64_t expected = pos;
+                    level->tail.compare_exchange_strong(expected, pos + 1, memory_order_acq_rel);
+                    level->head.store(pos + 1, memory_order_release);
+                    level->abandoned.fetch_add(1, memory_order_relaxed);
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Description: Removes and returns the highest priority item from the queue.
+     *              Must only be called by the single consumer.
+     *
+     * Return: The highest priority item (by value).
+     * Throws: out_of_range If no item is ready.
+     */
+    T dequeue() {
+        T item;
+        if (!tryDequeue(item)) {
+            throw out_of_range("Dequeue called on an empty SharedPriorityQueue");
+        }
+        return item;
+    }
+
+    /**
+     * Description: Gets the number of items enqueued or in flight across all levels.
+     *              Only a hint while producers are running.
+     */
+    size_t size() const {
+        size_t total = 0;
+        for (uint32_t l = 0; l < header()->levels; l++) {
+            const Level* level = levelAt(l);
+            uint64_t head = level->head.load(memory_order_acquire);
+            uint64_t tail = level->tail.load(memory_order_acquire);
+            total += tail > head ? tail - head : 0;
+        }
+        return total;
+    }
+
+    /**
+     * Description: Checks if the queue is empty (subject to the same caveat as size()).
+     */
+    bool is_empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * Description: Gets the number of slots discarded because their producer died mid-enqueue.
+     */
+    uint64_t abandonedCount() const {
+        uint64_t total = 0;
+        for (uint32_t l = 0; l < header()->levels; l++) {
+            total += levelAt(l)->abandoned.load(memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /**
+     * Description: Gets the number of priority levels (valid priorities are 0 .. levels()-1).
+     */
+    int levels() const {
+        return header()->levels;
+    }
+
+private:
+    static uint64_t alignUp(uint64_t value, uint64_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    static uint64_t stateWord(uint64_t pos, uint32_t tag) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(pos)) << 32) | tag;
+    }
+
+    static uint32_t positionOf(uint64_t state) {
+        return static_cast<uint32_t>(state >> 32);
+    }
+
+    // A claim is live while its PID exists. A crashed producer that has not been reaped yet
+    // still counts as alive, so its slot is only reclaimed once its parent waits on it.
+    static bool producerAlive(uint32_t tag) {
+        return kill(static_cast<pid_t>(tag), 0) == 0 || errno != ESRCH;
+    }
+
+    // The PID is looked up per call rather than cached so that a fork()ed child claims under its own PID
+    uint32_t ownTag() const {
+        return static_cast<uint32_t>(getpid());
+    }
+
+    void map(int fd, size_t size, const string& name) {
+        void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int err = errno;
+        close(fd);
+        if (addr == MAP_FAILED) {
+            throw runtime_error("mmap(" + name + ") failed: " + strerror(err));
+        }
+        base = static_cast<unsigned char*>(addr);
+        mappedSize = size;
+    }
+
+    void release(Level* level, Slot* slot, uint64_t pos, uint32_t slots) {
+        slot->state.store(stateWord(pos + slots, FREE), memory_order_release);
+        level->head.store(pos + 1, memory_order_release);
+    }
+
+    Header* header() const {
+        return reinterpret_cast<Header*>(base);
+    }
+
+    Level* levelAt(uint32_t level) const {
+        return reinterpret_cast<Level*>(base + header()->levelsOffset) + level;
+    }
+
+    Slot* slotAt(uint32_t level, uint64_t index) const {
+        return reinterpret_cast<Slot*>(base + header()->slotsOffset) + static_cast<uint64_t>(level) * header()->slotsPerLevel + index;
+    }
+};
+
+#endif // SHARED_PRIORITY_QUEUE_H
@@ -37,6 +37,32 @@ int main()
 	cout << "Memory Limit: " << process1.getMemoryLimit() << endl;
 	cout << "Open Files: " << process1.getOpenFiles(files) << endl << endl;
 
+	cout << " ******************************************" << endl;
+	cout << "charging memory to the process..." << endl;
+
+	MemoryBudget budget(5000);
+	cout << "Reserve 100 before admission: " << process1.reserveMemory(100) << endl;
+	cout << "Charge budget: " << process1.chargeBudget(budget) << endl;
+	cout << "Budget in use: " << budget.inUse() << endl;
+
+	cout << "Reserve 1500: " << process1.reserveMemory(1500) << endl;
+	cout << "Reserve 600 (over limit): " << process1.reserveMemory(600) << endl;
+	cout << "Memory Used: " << process1.getMemoryUsed() << endl;
+	cout << "Release 1000: " << process1.releaseMemory(1000) << endl;
+	cout << "Release 1000 (more than used): " << process1.releaseMemory(1000) << endl;
+	cout << "Memory Used: " << process1.getMemoryUsed() << endl;
+	cout << "Release budget: " << process1.releaseBudget() << endl;
+	cout << "Budget in use: " << budget.inUse() << endl;
+
+	process1.chargeBudget(budget);
+	{
+		PCB copy(process1);
+		cout << "Copy holds a charge: " << (copy.getBudget() ? "Yes (unexpected)" : "No") << endl;
+	}
+	cout << "Budget in use after copy is destroyed: " << budget.inUse() << endl;
+	process1 = PCB();
+	cout << "Budget in use after overwriting the process: " << budget.inUse() << endl << endl;
+
 
 	return 0;
 }
@@ -0,0 +1,130 @@
+#include <iostream>
+#include <string>
+#include <stdexcept> // For catching exceptions
+
+#include "admissionControl.h"
+
+using namespace std;
+
+// Stands in for Scheduler: queues each admitted process by its priority
+struct ReadyQueue {
+    PriorityQueue<PCB*> queue;
+
+    void addReadyProcess(PCB* process) {
+        cout << "  -> ready: PID " << process->getPID() << " (priority " << process->getPriority()
+             << ", limit " << process->getMemoryLimit() << ")" << endl;
+        queue.enqueue(process, process->getPriority());
+    }
+};
+
+// Helper function to make a process with a priority and memory limit
+PCB makeProcess(int pid, int priority, int limit) {
+    PCB process(pid, pid * 1000);
+    process.setPriority(priority);
+    process.setMemoryLimit(limit);
+    return process;
+}
+
+// Helper function to print status (reduces repetition)
+void print_status(const AdmissionController<ReadyQueue>& ac, const MemoryBudget& budget,
+                  const ReadyQueue& ready, const string& label) {
+    cout << "\n--- Status: " << label << " ---" << endl;
+    cout << "Budget in use: " << budget.inUse() << " / " << budget.getCapacity() << endl;
+    cout << "Ready: " << ready.queue.size() << ", deferred: " << ac.deferredCount() << endl;
+    cout << "-------------------------" << endl;
+}
+
+// Helper function to admit a process and print the outcome after any ready output
+void admit_and_report(AdmissionController<ReadyQueue>& ac, PCB* process, const string& label) {
+    cout << label << endl;
+    bool admitted = ac.admit(process);
+    cout << "  admitted: " << (admitted ? "Yes" : "No (deferred)") << endl;
+}
+
+int main() {
+    cout << "===== Testing AdmissionController / MemoryBudget =====" << endl;
+
+    cout << "\n>>> Testing MemoryBudget reserve/release..." << endl;
+    MemoryBudget small(10);
+    cout << "Reserve 8: " << small.reserve(8) << endl;
+    cout << "Reserve 3 (over capacity): " << small.reserve(3) << endl;
+    cout << "Release 9 (more than in use): " << small.release(9) << endl;
+    cout << "Release -1 (negative): " << small.release(static_cast<size_t>(-1)) << endl;
+    cout << "Release 8: " << small.release(8) << endl;
+    cout << "In use: " << small.inUse() << endl;
+
+    MemoryBudget budget(100);
+    ReadyQueue ready;
+    AdmissionController<ReadyQueue> ac(ready, budget);
+
+    PCB a = makeProcess(1, 5, 60);
+    PCB b = makeProcess(2, 3, 50);
+    PCB c = makeProcess(3, 1, 30);
+    PCB d = makeProcess(4, 3, 10);
+    PCB e = makeProcess(5, 2, 40);
+
+    cout << "\n>>> Admitting until the budget is full..." << endl;
+    admit_and_report(ac, &a, "Admit PID 1 (limit 60)");
+    admit_and_report(ac, &b, "Admit PID 2 (limit 50, does not fit)");
+    admit_and_report(ac, &c, "Admit PID 3 (limit 30, higher priority than PID 2 and fits)");
+    admit_and_report(ac, &d, "Admit PID 4 (limit 10, fits but PID 2 waits at the same priority)");
+    admit_and_report(ac, &e, "Admit PID 5 (limit 40, does not fit)");
+    admit_and_report(ac, &b, "Admit PID 2 again (already deferred, ignored)");
+    print_status(ac, budget, ready, "After Admitting");
+
+    cout << "\n>>> Releasing PID 1 (expecting PID 5; PID 2 still does not fit and PID 4 stays behind it)..." << endl;
+    int admitted = ac.release(&a);
+    cout << "Admitted on release: " << admitted << endl;
+    print_status(ac, budget, ready, "After Releasing PID 1");
+
+    cout << "\n>>> Releasing PID 3 (expecting PID 2, then PID 4)..." << endl;
+    admitted = ac.release(&c);
+    cout << "Admitted on release: " << admitted << endl;
+    print_status(ac, budget, ready, "After Releasing PID 3");
+
+    cout << "\n>>> Testing invalid admit/release..." << endl;
+    try {
+        ac.release(&a);
+    } catch (const invalid_argument& ex) {
+        cout << "Caught expected exception on double release: " << ex.what() << endl;
+    }
+    MemoryBudget other(100);
+    PCB foreign = makeProcess(7, 0, 10);
+    foreign.chargeBudget(other);
+    try {
+        ac.admit(&foreign);
+    } catch (const invalid_argument& ex) {
+        cout << "Caught expected exception on admit charged to another budget: " << ex.what() << endl;
+    }
+    PCB huge = makeProcess(6, 0, 500);
+    try {
+        ac.admit(&huge);
+    } catch (const invalid_argument& ex) {
+        cout << "Caught expected exception on oversized limit: " << ex.what() << endl;
+    }
+
+    cout << "\n>>> Dispatch order of admitted processes..." << endl;
+    while (!ready.queue.is_empty()) {
+        cout << "Dequeued: PID " << ready.queue.dequeue()->getPID() << endl;
+    }
+
+    cout << "\n>>> Re-admitting PID 5 (already charged, e.g. back from I/O)..." << endl;
+    admit_and_report(ac, &e, "Admit PID 5 again");
+    print_status(ac, budget, ready, "After Re-admit");
+    ready.queue.clear();
+
+    cout << "\n>>> Releasing with a deferred head that was charged elsewhere..." << endl;
+    PCB f = makeProcess(8, 0, 50);
+    PCB g = makeProcess(9, 1, 20);
+    admit_and_report(ac, &f, "Admit PID 8 (limit 50, does not fit)");
+    admit_and_report(ac, &g, "Admit PID 9 (limit 20, fits but PID 8 waits ahead)");
+    f.chargeBudget(other);
+    cout << "PID 8 charged to another budget while deferred" << endl;
+    admitted = ac.release(&e);
+    cout << "Admitted on release: " << admitted << endl;
+    print_status(ac, budget, ready, "After Dropping the Stale Head");
+
+    cout << "\n===== Admission Tests Complete =====" << endl;
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <stdexcept> // For catching exceptions
+#include <thread>
+#include <atomic>
+
+#include "monitoredPriorityQueue.h"
+
+using namespace std;
+
+// Helper function to print a snapshot
+void print_snapshot(const QueueSnapshot<int>& snap, const string& label) {
+    cout << "\n--- Snapshot: " << label << " ---" << endl;
+    cout << "Total: " << snap.total << ", next ticket: " << snap.nextTicket << endl;
+    for (const LevelSnapshot<int>& level : snap.levels) {
+        cout << "  " << (level.overflow ? "Overflow from priority " : "Priority ") << level.priority << ": depth " << level.depth
+             << ", oldest " << level.oldestItem << " (ticket " << level.oldestTicket << ")" << endl;
+    }
+    const LevelSnapshot<int>* oldest = snap.oldest();
+    if (oldest) {
+        cout << "Oldest waiting: " << oldest->oldestItem << " at priority " << oldest->priority << endl;
+    } else {
+        cout << "Oldest waiting: N/A (Queue is empty)" << endl;
+    }
+    cout << "-------------------------" << endl;
+}
+
+int main() {
+    cout << "===== Testing MonitoredPriorityQueue Component =====" << endl;
+
+    MonitoredPriorityQueue<int> pq(4);
+    print_snapshot(pq.snapshot(), "Initial State");
+
+    cout << "\n>>> Enqueuing items..." << endl;
+    pq.enqueue(30, 3);
+    pq.enqueue(10, 1);
+    pq.enqueue(31, 3);
+    pq.enqueue(20, 2);
+    pq.enqueue(11, 1);
+    print_snapshot(pq.snapshot(), "After Enqueuing");
+    cout << pq.toString() << endl;
+
+    cout << "\n>>> Dequeuing two items..." << endl;
+    cout << "Dequeued: " << pq.dequeue() << endl;
+    cout << "Dequeued: " << pq.dequeue() << endl;
+    print_snapshot(pq.snapshot(), "After Dequeuing Priority 1");
+
+    cout << "\n>>> Enqueuing more priorities than the summary has rows..." << endl;
+    pq.enqueue(50, 5);
+    pq.enqueue(60, 6);
+    pq.enqueue(80, 8);
+    pq.enqueue(70, 7);
+    pq.enqueue(71, 7);
+    print_snapshot(pq.snapshot(), "With Overflow");
+
+    cout << "\n>>> Draining through the overflow priorities..." << endl;
+    while (pq.size() > 2) {
+        cout << "Dequeued: " << pq.dequeue() << endl;
+    }
+    print_snapshot(pq.snapshot(), "After Draining Overflow");
+
+    cout << "\n>>> Testing clear()..." << endl;
+    pq.clear();
+    print_snapshot(pq.snapshot(), "After Clear");
+    try {
+        pq.dequeue();
+    } catch (const out_of_range& e) {
+        cout << "Caught expected exception on dequeue: " << e.what() << endl;
+    }
+
+    cout << "\n>>> Reading snapshots while the writer runs..." << endl;
+    MonitoredPriorityQueue<int> busy(4);   // Fewer rows than priorities, so the overflow row is exercised too
+    atomic<bool> done(false);
+    long snapshots = 0;
+    long inconsistent = 0;
+    thread reader([&]() {
+        while (!done.load()) {
+            QueueSnapshot<int> snap = busy.snapshot();
+            size_t sum = 0;
+            for (const LevelSnapshot<int>& level : snap.levels) {
+                sum += level.depth;
+            }
+            if (sum != snap.total) {
+                inconsistent++;
+            }
+            snapshots++;
+        }
+    });
+    for (int round = 0; round < 20000; round++) {
+        for (int p = 0; p < 8; p++) {
+            busy.enqueue(round, p);
+        }
+        for (int p = 0; p < 8; p++) {
+            busy.dequeue();
+        }
+    }
+    done.store(true);
+    reader.join();
+    cout << "Snapshots taken: " << (snapshots > 0 ? "yes" : "no") << ", inconsistent: " << inconsistent << endl;
+
+    cout << "\n===== MonitoredPriorityQueue Tests Complete =====" << endl;
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <iostream>
+#include <stdexcept>
+
+#include "processRegistry.h"
+
+using namespace std;
+
+// *******************************************
+// This is just to test the ProcessRegistry class
+// *******************************************
+int main()
+{
+    cout << "===== Testing ProcessRegistry =====" << endl;
+
+    ProcessRegistry registry(3);
+
+    cout << "\n>>> Creating processes..." << endl;
+    ProcessHandle a = registry.create(1000);
+    ProcessHandle b = registry.create(2000);
+    ProcessHandle c = registry.create(3000);
+    ProcessHandle full = registry.create(4000);
+
+    cout << "PIDs: " << a.pid << ", " << b.pid << ", " << c.pid << endl;
+    cout << "Create when full valid? " << (full.valid() ? "Yes (unexpected)" : "No") << endl;
+    cout << "Size: " << registry.size() << " / " << registry.capacity() << endl;
+
+    cout << "\n>>> Looking up by handle and by PID..." << endl;
+    cout << "get(b) stack pointer: " << registry.get(b)->getStackPointer() << endl;
+    cout << "find(" << c.pid << ") PID: " << registry.find(c.pid)->getPID() << endl;
+    cout << "find(99) found? " << (registry.find(99) ? "Yes (unexpected)" : "No") << endl;
+
+    cout << "\n>>> Removing and recycling a PID..." << endl;
+    cout << "remove(b): " << registry.remove(b) << endl;
+    cout << "remove(b) again: " << registry.remove(b) << endl;
+    cout << "get(b) after remove found? " << (registry.get(b) ? "Yes (unexpected)" : "No") << endl;
+
+    ProcessHandle d = registry.create(5000);
+    cout << "New process reuses PID " << d.pid << " (generation " << d.generation
+         << ", stale handle generation " << b.generation << ")" << endl;
+    cout << "Stale handle get(b) found? " << (registry.get(b) ? "Yes (unexpected)" : "No") << endl;
+    cout << "get(d) stack pointer: " << registry.get(d)->getStackPointer() << endl;
+    cout << "handleOf(" << d.pid << ") generation: " << registry.handleOf(d.pid).generation << endl;
+
+    cout << "\n>>> Recycling order (oldest released PID first)..." << endl;
+    registry.remove(a);
+    registry.remove(c);
+    ProcessHandle e = registry.create(6000);
+    ProcessHandle f = registry.create(7000);
+    cout << "Released PIDs " << a.pid << " then " << c.pid << ", reused " << e.pid << " then " << f.pid << endl;
+
+    cout << "\n>>> Removing an admitted process returns its memory charge..." << endl;
+    MemoryBudget budget(10000);
+    size_t before = budget.inUse();
+    registry.get(d)->setMemoryLimit(4000);
+    registry.get(d)->chargeBudget(budget);
+    cout << "Budget in use after charging PID " << d.pid << ": " << budget.inUse() << endl;
+    registry.remove(d);
+    cout << "Budget in use after remove: " << budget.inUse() << " (before: " << before << ")" << endl;
+
+    cout << "\n>>> Testing invalid capacity..." << endl;
+    try {
+        ProcessRegistry empty(0);
+    } catch (const invalid_argument& e) {
+        cout << "Caught expected exception: " << e.what() << endl;
+    }
+
+    cout << "\n===== ProcessRegistry Tests Complete =====" << endl;
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <iostream>
+#include <string>
+#include <stdexcept> // For catching exceptions
+#include <chrono>
+
+#include <sched.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "sharedPriorityQueue.h"
+
+using namespace std;
+
+// *******************************************
+// This is just to test the SharedPriorityQueue class.
+// Producers are forked child processes that attach by name and enqueue PIDs.
+// *******************************************
+int main()
+{
+    cout << "===== Testing SharedPriorityQueue Component =====" << endl;
+
+    const string name = "/test_shared_pq_" + to_string(getpid());
+    const int producers = 3;
+    const int perProducer = 4;
+
+    SharedPriorityQueue<int> pq(name, 4, 16);
+    cout << "Created " << name << " with " << pq.levels() << " levels" << endl;
+
+    cout << "\n>>> Testing dequeue on empty queue..." << endl;
+    try {
+        pq.dequeue();
+    } catch (const out_of_range& e) {
+        cout << "Caught expected exception on dequeue: " << e.what() << endl;
+    }
+
+    cout << "\n>>> Forking " << producers << " producers..." << endl;
+    for (int p = 0; p < producers; p++) {
+        if (fork() == 0) {
+            SharedPriorityQueue<int> producer(name);
+            for (int i = 0; i < perProducer; i++) {
+                // PID-like payload: producer * 100 + sequence, priority cycles over the levels
+                producer.enqueue((p + 1) * 100 + i, i % producer.levels());
+            }
+            _exit(0);
+        }
+    }
+    for (int p = 0; p < producers; p++) {
+        wait(nullptr);
+    }
+    cout << "Size after producers exit: " << pq.size() << endl;
+
+    cout << "\n>>> Testing out-of-range priority..." << endl;
+    try {
+        pq.enqueue(1, 4);
+    } catch (const out_of_range& e) {
+        cout << "Caught expected exception on enqueue: " << e.what() << endl;
+    }
+
+    cout << "\n>>> Dequeuing items (expecting lowest level first, FIFO per producer within a level)..." << endl;
+    int item;
+    while (pq.tryDequeue(item)) {
+        cout << "Dequeued: " << item << " (Size left: " << pq.size() << ")" << endl;
+    }
+    cout << "Abandoned slots: " << pq.abandonedCount() << endl;
+
+    cout << "\n>>> Filling one level..." << endl;
+    int accepted = 0;
+    while (pq.enqueue(accepted, 0)) {
+        accepted++;
+    }
+    cout << "Level 0 accepted " << accepted << " items before reporting full" << endl;
+
+    SharedPriorityQueue<int>::remove(name);
+
+    cout << "\n>>> Contended producers on one level..." << endl;
+    const string busyName = name + "_busy";
+    const int busyProducers = 8;
+    const int busyPerProducer = 2000;
+    SharedPriorityQueue<int> busy(busyName, 1, 64);
+    pid_t busyPids[busyProducers];
+    for (int p = 0; p < busyProducers; p++) {
+        busyPids[p] = fork();
+        if (busyPids[p] == 0) {
+            SharedPriorityQueue<int> producer(busyName);
+            SharedPriorityQueue<int>::Reservation reservation;
+            for (int i = 0; i < busyPerProducer; i++) {
+                int* slot;
+                while ((slot = producer.claim(0, reservation)) == nullptr) {
+                    sched_yield();
+                }
+                sched_yield();   // Stall between claim and publish so other producers pile up behind this slot
+                *slot = p * busyPerProducer + i;
+                producer.publish(reservation);
+            }
+            _exit(0);
+        }
+    }
+    int received = 0;
+    int outOfOrder = 0;
+    int lastSeen[busyProducers];
+    for (int p = 0; p < busyProducers; p++) {
+        lastSeen[p] = -1;
+    }
+    // Give up after a few seconds without progress instead of hanging if items are lost
+    auto deadline = chrono::steady_clock::now() + chrono::seconds(5);
+    while (received < busyProducers * busyPerProducer && chrono::steady_clock::now() < deadline) {
+        if (busy.tryDequeue(item)) {
+            int producer = item / busyPerProducer;
+            int sequence = item % busyPerProducer;
+            if (sequence <= lastSeen[producer]) {
+                outOfOrder++;
+            }
+            lastSeen[producer] = sequence;
+            received++;
+            deadline = chrono::steady_clock::now() + chrono::seconds(5);
+        } else {
+            sched_yield();
+        }
+    }
+    for (int p = 0; p < busyProducers; p++) {
+        kill(busyPids[p], SIGKILL);   // No-op unless the consumer gave up with producers still stuck
+        waitpid(busyPids[p], nullptr, 0);
+    }
+    cout << "Dequeued " << received << " of " << busyProducers * busyPerProducer
+         << " items, out of order per producer: " << outOfOrder << endl;
+    SharedPriorityQueue<int>::remove(busyName);
+
+    cout << "\n>>> Producer crashing between claim and publish..." << endl;
+    const string crashName = name + "_crash";
+    SharedPriorityQueue<int> crash(crashName, 2, 8);
+    if (fork() == 0) {
+        SharedPriorityQueue<int> producer(crashName);
+        SharedPriorityQueue<int>::Reservation reservation;
+        producer.claim(0, reservation);
+        _exit(1);   // Dies holding the claim
+    }
+    wait(nullptr);   // Reap it so its PID no longer exists
+    crash.enqueue(1, 0);
+    crash.enqueue(2, 0);
+    crash.enqueue(3, 1);
+    while (crash.tryDequeue(item)) {
+        cout << "Dequeued: " << item << endl;
+    }
+    cout << "Abandoned slots: " << crash.abandonedCount() << ", size left: " << crash.size() << endl;
+    int refilled = 0;
+    while (crash.enqueue(refilled, 0)) {
+        refilled++;
+    }
+    cout << "Level 0 accepted " << refilled << " items after recovery" << endl;
+    SharedPriorityQueue<int>::remove(crashName);
+
+    cout << "\n===== SharedPriorityQueue Tests Complete =====" << endl;
+
+    return 0;
+}